@@ -0,0 +1,452 @@
+// graph_compressed_adjacency_list.cpp
+// This file demonstrates how to store a graph using a compressed adjacency list in C++.
+// Each neighbor list is sorted and stored as gaps (differences between consecutive neighbors),
+// and every gap is written as a variable-length integer (varint) using as few bytes as possible.
+// Parallel edges are kept, like in the other representations: a repeated neighbor is just a gap of 0.
+// Neighbors are decoded on the fly through an iterator, so BFS and DFS never need the uncompressed lists.
+// This representation is useful for large sparse graphs that do not fit in memory as vector<vector<int>>.
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <stack>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>    // For mt19937 and uniform_int_distribution
+#include <stdexcept> // For invalid_argument, logic_error and length_error
+
+using namespace std;
+
+// Graph class using a compressed (gap + varint encoded) adjacency list.
+// Edges must be added in source order (all edges of vertex 0, then of vertex 1, ...),
+// so only the neighbor list of the current vertex is kept uncompressed while building.
+class CompressedGraph {
+private:
+    static const int BLOCK_SIZE = 64; // Vertices that share one 64-bit base offset
+
+    int numVertices; // Number of vertices in the graph
+    int buildVertex; // Vertex whose edges are being added (-1 before the first edge)
+    int nextOffsetVertex; // Next vertex whose start offset has not been recorded yet
+    bool built; // True after build(); edges can only be added before, and the graph only read after
+    vector<int> currentNeighbors; // Neighbors of 'buildVertex', not yet encoded
+    vector<uint8_t> encodedNeighbors; // All neighbor lists, encoded back to back
+
+    // The start of the list of 'u' is blockOffsets[u / BLOCK_SIZE] + relativeOffsets[u],
+    // and its end is the start of 'u + 1'. This costs about 4 bytes per vertex
+    // instead of 8, while still allowing more than 4 GiB of encoded data.
+    vector<uint64_t> blockOffsets;
+    vector<uint32_t> relativeOffsets;
+
+    // Writes 'value' using 7 bits per byte; the high bit tells if more bytes follow
+    void writeVarint(uint32_t value) {
+        while (value >= 0x80) {
+            encodedNeighbors.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        encodedNeighbors.push_back(static_cast<uint8_t>(value));
+    }
+
+    // Records the current end of the encoded data as the start of 'nextOffsetVertex'
+    void recordNextOffset() {
+        uint64_t position = encodedNeighbors.size();
+        if (nextOffsetVertex % BLOCK_SIZE == 0) {
+            blockOffsets.push_back(position);
+        }
+        uint64_t relative = position - blockOffsets.back();
+        if (relative > UINT32_MAX) {
+            throw length_error("CompressedGraph: more than 4 GiB of edges in one block of vertices");
+        }
+        relativeOffsets.push_back(static_cast<uint32_t>(relative));
+        ++nextOffsetVertex;
+    }
+
+    // Sorts and encodes the neighbors of 'buildVertex', then clears the buffer
+    void flushCurrentVertex() {
+        if (buildVertex < 0) return;
+
+        // Vertices skipped since the last flush have no edges, so they start (and end) here too
+        while (nextOffsetVertex <= buildVertex) {
+            recordNextOffset();
+        }
+
+        // Sorting makes every gap non-negative and usually small
+        sort(currentNeighbors.begin(), currentNeighbors.end());
+
+        int previous = 0;
+        for (int v : currentNeighbors) {
+            writeVarint(static_cast<uint32_t>(v - previous));
+            previous = v;
+        }
+        currentNeighbors.clear();
+    }
+
+    // Throws if 'vertex' is not a valid vertex of the graph
+    void checkVertex(int vertex) const {
+        if (vertex < 0 || vertex >= numVertices) {
+            throw invalid_argument("CompressedGraph: vertex out of range");
+        }
+    }
+
+    // Throws unless build() has been called
+    void checkBuilt() const {
+        if (!built) {
+            throw logic_error("CompressedGraph: build() must be called before reading the graph");
+        }
+    }
+
+    // Returns the position in 'encodedNeighbors' where the list of 'u' starts
+    uint64_t offset(int u) const {
+        return blockOffsets[u / BLOCK_SIZE] + relativeOffsets[u];
+    }
+
+public:
+    // Iterator that decodes the neighbors of a vertex one at a time
+    class NeighborIterator {
+    private:
+        const uint8_t* current; // Start of the encoded gap for the current neighbor
+        const uint8_t* next; // Start of the encoded gap for the following neighbor
+        const uint8_t* end; // End of this vertex's encoded list
+        int value; // Decoded value of the current neighbor
+
+        // Reads the varint at 'current', adds it to the previous neighbor and moves 'next' past it
+        void decode(int previous) {
+            const uint8_t* p = current;
+            uint32_t gap = *p & 0x7F;
+            int shift = 7;
+            while (*p++ & 0x80) {
+                gap |= static_cast<uint32_t>(*p & 0x7F) << shift;
+                shift += 7;
+            }
+            next = p;
+            value = previous + static_cast<int>(gap);
+        }
+
+    public:
+        NeighborIterator(const uint8_t* listBegin, const uint8_t* listEnd)
+            : current(listBegin), next(listBegin), end(listEnd), value(0) {
+            // The first neighbor is stored as a gap from 0, so it is just its own value
+            if (current != end) decode(0);
+        }
+
+        int operator*() const { return value; }
+
+        NeighborIterator& operator++() {
+            current = next;
+            if (current != end) decode(value);
+            return *this;
+        }
+
+        bool operator==(const NeighborIterator& other) const { return current == other.current; }
+        bool operator!=(const NeighborIterator& other) const { return current != other.current; }
+    };
+
+    // Range returned by neighbors(), so it can be used in a range-based for loop
+    class NeighborRange {
+    private:
+        const uint8_t* first;
+        const uint8_t* last;
+
+    public:
+        NeighborRange(const uint8_t* listBegin, const uint8_t* listEnd) : first(listBegin), last(listEnd) {}
+        NeighborIterator begin() const { return NeighborIterator(first, last); }
+        NeighborIterator end() const { return NeighborIterator(last, last); }
+    };
+
+    // Constructor: initializes the graph with a given number of vertices
+    CompressedGraph(int vertices) {
+        numVertices = vertices;
+        buildVertex = -1;
+        nextOffsetVertex = 0;
+        built = false;
+        blockOffsets.reserve(vertices / BLOCK_SIZE + 1);
+        relativeOffsets.reserve(vertices + 1);
+    }
+
+    // Adds an edge from vertex 'u' to vertex 'v' (takes effect after build() is called).
+    // Edges must come in source order: 'u' can never be smaller than in the previous call.
+    // Adding the same edge twice keeps both copies (parallel edges).
+    void addEdge(int u, int v) {
+        if (built) {
+            throw logic_error("CompressedGraph: cannot add edges after build()");
+        }
+        checkVertex(u);
+        checkVertex(v);
+        if (u < buildVertex) {
+            throw invalid_argument("CompressedGraph: edges must be added in source order");
+        }
+        if (u != buildVertex) {
+            flushCurrentVertex();
+            buildVertex = u;
+        }
+        currentNeighbors.push_back(v);
+        // For undirected graphs, each edge must also be added as (v, u) when vertex 'v' is reached
+    }
+
+    // Adds all the neighbors of vertex 'u' at once (same ordering rule as addEdge)
+    void addNeighbors(int u, const vector<int>& neighborList) {
+        for (int v : neighborList) {
+            addEdge(u, v);
+        }
+    }
+
+    // Encodes the last vertex and finishes the offsets; call it once after adding all edges
+    void build() {
+        if (built) {
+            throw logic_error("CompressedGraph: build() can only be called once");
+        }
+        flushCurrentVertex();
+        while (nextOffsetVertex <= numVertices) {
+            recordNextOffset(); // Also records the end of the last list
+        }
+        vector<int>().swap(currentNeighbors); // The buffer is no longer needed
+        encodedNeighbors.shrink_to_fit();
+        built = true;
+    }
+
+    // Returns the neighbors of vertex 'u', decoded lazily while iterating
+    NeighborRange neighbors(int u) const {
+        checkBuilt();
+        checkVertex(u);
+        const uint8_t* data = encodedNeighbors.data();
+        return NeighborRange(data + offset(u), data + offset(u + 1));
+    }
+
+    // Returns how many bytes are used to store the graph structure
+    size_t memoryUsage() const {
+        return encodedNeighbors.capacity() * sizeof(uint8_t)
+             + blockOffsets.capacity() * sizeof(uint64_t)
+             + relativeOffsets.capacity() * sizeof(uint32_t);
+    }
+
+    // Performs Breadth-First Search and returns the vertices in the order they were visited
+    vector<int> breadthFirstSearch(int startVertex) const {
+        checkBuilt();
+        checkVertex(startVertex);
+
+        vector<bool> visited(numVertices, false); // Keeps track of visited vertices
+        vector<int> order; // Visiting order
+        queue<int> vertexQueue; // Queue for BFS
+
+        visited[startVertex] = true;
+        vertexQueue.push(startVertex);
+
+        while (!vertexQueue.empty()) {
+            int currentVertex = vertexQueue.front();
+            vertexQueue.pop();
+            order.push_back(currentVertex);
+
+            // Neighbors are decoded one by one as the loop advances
+            for (int neighbor : neighbors(currentVertex)) {
+                if (!visited[neighbor]) {
+                    visited[neighbor] = true;
+                    vertexQueue.push(neighbor);
+                }
+            }
+        }
+        return order;
+    }
+
+    // Performs Depth-First Search and returns the vertices in the order they were visited.
+    // An explicit stack of iterators is used instead of recursion, so large graphs do not overflow
+    // the call stack; each iterator remembers where decoding stopped for its vertex.
+    vector<int> depthFirstSearch(int startVertex) const {
+        checkBuilt();
+        checkVertex(startVertex);
+
+        vector<bool> visited(numVertices, false); // Keeps track of visited vertices
+        vector<int> order; // Visiting order
+        stack<pair<NeighborIterator, NeighborIterator>> pending; // (next neighbor, end) for each open vertex
+
+        visited[startVertex] = true;
+        order.push_back(startVertex);
+        NeighborRange startRange = neighbors(startVertex);
+        pending.push({startRange.begin(), startRange.end()});
+
+        while (!pending.empty()) {
+            NeighborIterator& it = pending.top().first;
+            if (it == pending.top().second) {
+                pending.pop(); // All neighbors explored: backtrack
+                continue;
+            }
+            int neighbor = *it;
+            ++it;
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                order.push_back(neighbor);
+                NeighborRange range = neighbors(neighbor);
+                pending.push({range.begin(), range.end()});
+            }
+        }
+        return order;
+    }
+
+    // Prints the (decoded) adjacency list of the graph
+    void printGraph() const {
+        cout << "Compressed Adjacency List Representation:" << endl;
+        for (int i = 0; i < numVertices; ++i) {
+            cout << "Vertex " << i << ": ";
+            for (int neighbor : neighbors(i)) {
+                cout << neighbor << " ";
+            }
+            cout << endl;
+        }
+    }
+};
+
+// Plain vector<vector<int>> BFS, used as the baseline in the benchmark below
+vector<int> uncompressedBreadthFirstSearch(const vector<vector<int>>& adjacencyList, int startVertex) {
+    vector<bool> visited(adjacencyList.size(), false);
+    vector<int> order;
+    queue<int> vertexQueue;
+
+    visited[startVertex] = true;
+    vertexQueue.push(startVertex);
+
+    while (!vertexQueue.empty()) {
+        int currentVertex = vertexQueue.front();
+        vertexQueue.pop();
+        order.push_back(currentVertex);
+
+        for (int neighbor : adjacencyList[currentVertex]) {
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                vertexQueue.push(neighbor);
+            }
+        }
+    }
+    return order;
+}
+
+// Plain vector<vector<int>> DFS, used as the baseline in the benchmark below.
+// It keeps a (next neighbor, end) stack like the compressed DFS, so both visit vertices in the same order.
+vector<int> uncompressedDepthFirstSearch(const vector<vector<int>>& adjacencyList, int startVertex) {
+    vector<bool> visited(adjacencyList.size(), false);
+    vector<int> order;
+    stack<pair<vector<int>::const_iterator, vector<int>::const_iterator>> pending;
+
+    visited[startVertex] = true;
+    order.push_back(startVertex);
+    pending.push({adjacencyList[startVertex].begin(), adjacencyList[startVertex].end()});
+
+    while (!pending.empty()) {
+        vector<int>::const_iterator& it = pending.top().first;
+        if (it == pending.top().second) {
+            pending.pop();
+            continue;
+        }
+        int neighbor = *it;
+        ++it;
+        if (!visited[neighbor]) {
+            visited[neighbor] = true;
+            order.push_back(neighbor);
+            pending.push({adjacencyList[neighbor].begin(), adjacencyList[neighbor].end()});
+        }
+    }
+    return order;
+}
+
+// Runs 'traversal' several times and returns the average time in milliseconds; 'order' receives the last result
+template <typename Traversal>
+double timeTraversal(Traversal traversal, vector<int>& order) {
+    const int runs = 5;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < runs; ++r) {
+        order = traversal();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / runs;
+}
+
+// Compares memory and BFS/DFS time of the compressed graph against vector<vector<int>>.
+// Edges connect nearby vertices most of the time (like real road or web graphs),
+// which is when gap encoding pays off the most.
+// Returns false if the two representations produce different traversals.
+bool runBenchmark(int numVertices, int edgesPerVertex) {
+    mt19937 generator(42); // Fixed seed so runs are comparable across platforms
+    uniform_int_distribution<int> edgeKind(0, 9);
+    uniform_int_distribution<int> localDistance(1, 1000);
+    uniform_int_distribution<int> anyVertex(0, numVertices - 1);
+
+    vector<vector<int>> adjacencyList(numVertices);
+    CompressedGraph compressed(numVertices);
+    for (int u = 0; u < numVertices; ++u) {
+        vector<int>& list = adjacencyList[u];
+        for (int k = 0; k < edgesPerVertex; ++k) {
+            if (edgeKind(generator) < 8) {
+                list.push_back((u + localDistance(generator)) % numVertices); // Local edge
+            } else {
+                list.push_back(anyVertex(generator)); // Long-range edge
+            }
+        }
+        // Sort like the compressed lists; duplicates are dropped here so both graphs start from the same lists
+        sort(list.begin(), list.end());
+        list.erase(unique(list.begin(), list.end()), list.end());
+        compressed.addNeighbors(u, list);
+    }
+    compressed.build();
+
+    size_t uncompressedBytes = adjacencyList.capacity() * sizeof(vector<int>);
+    for (const vector<int>& list : adjacencyList) {
+        uncompressedBytes += list.capacity() * sizeof(int);
+    }
+    size_t compressedBytes = compressed.memoryUsage();
+
+    vector<int> uncompressedBfs, compressedBfs, uncompressedDfs, compressedDfs;
+    double uncompressedBfsMs = timeTraversal([&] { return uncompressedBreadthFirstSearch(adjacencyList, 0); }, uncompressedBfs);
+    double compressedBfsMs = timeTraversal([&] { return compressed.breadthFirstSearch(0); }, compressedBfs);
+    double uncompressedDfsMs = timeTraversal([&] { return uncompressedDepthFirstSearch(adjacencyList, 0); }, uncompressedDfs);
+    double compressedDfsMs = timeTraversal([&] { return compressed.depthFirstSearch(0); }, compressedDfs);
+
+    cout << "Benchmark (" << numVertices << " vertices, " << edgesPerVertex << " edges per vertex):" << endl;
+    cout << "  vector<vector<int>>: " << uncompressedBytes / 1024 << " KiB, BFS " << uncompressedBfsMs
+         << " ms, DFS " << uncompressedDfsMs << " ms" << endl;
+    cout << "  compressed:          " << compressedBytes / 1024 << " KiB, BFS " << compressedBfsMs
+         << " ms, DFS " << compressedDfsMs << " ms" << endl;
+    cout << "  memory reduction:    " << (double)uncompressedBytes / compressedBytes << "x" << endl;
+    cout << "  BFS time ratio:      " << compressedBfsMs / uncompressedBfsMs << endl;
+    cout << "  DFS time ratio:      " << compressedDfsMs / uncompressedDfsMs << endl;
+
+    // Both representations store the same sorted lists, so the visiting orders must be identical
+    if (compressedBfs != uncompressedBfs || compressedDfs != uncompressedDfs) {
+        cerr << "ERROR: compressed traversal order differs from the uncompressed one" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    // Example: create a graph with 5 vertices
+    CompressedGraph graph(5);
+
+    // Add some edges (in source order)
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 4);
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+
+    // Encode the last vertex; the graph can only be traversed after this
+    graph.build();
+
+    // Print the adjacency list
+    graph.printGraph();
+
+    // Traverse the graph decoding neighbors on the fly
+    cout << "BFS traversal starting from vertex 0: ";
+    for (int vertex : graph.breadthFirstSearch(0)) cout << vertex << " ";
+    cout << endl;
+
+    cout << "DFS traversal starting from vertex 0: ";
+    for (int vertex : graph.depthFirstSearch(0)) cout << vertex << " ";
+    cout << endl << endl;
+
+    // Compare against the uncompressed representation on a larger graph
+    if (!runBenchmark(1000000, 16)) {
+        return 1;
+    }
+
+    return 0;
+}